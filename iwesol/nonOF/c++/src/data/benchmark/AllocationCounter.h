@@ -0,0 +1,67 @@
+/*---------------------------------------------------------------------------*\
+                               |
+  _____        _______ ____    | IWESOL: IWES Open Library
+ |_ _\ \      / / ____/ ___|   |
+  | | \ \ /\ / /|  _| \___ \   | Copyright: Fraunhofer Institute for Wind
+  | |  \ V  V / | |___ ___) |  | Energy and Energy System Technology IWES
+ |___|  \_/\_/  |_____|____/   |
+                               | http://www.iwes.fraunhofer.de
+                               |
+-------------------------------------------------------------------------------
+License
+    This file is part of IWESOL.
+
+    IWESOL is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IWESOL is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with IWESOL.  If not, see <http://www.gnu.org/licenses/>.
+
+
+Description
+    Replacements of the global operator new/delete that count the number
+    of allocations, for dataBenchmark and dataTest. The counter is atomic,
+    such that it stays exact with threads. Include in exactly one source
+    file of an executable, the operators are not inline.
+
+SourceFiles
+    AllocationCounter.h
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef ALLOCATIONCOUNTER_H_
+#define ALLOCATIONCOUNTER_H_
+
+#include <cstdlib>
+#include <new>
+
+/// the number of calls of operator new and new[]
+static volatile unsigned long allocations = 0;
+
+void * operator new(std::size_t size) throw(std::bad_alloc){
+	__sync_fetch_and_add(&allocations, 1UL);
+	void * p = std::malloc(size > 0 ? size : 1);
+	if(!p) throw std::bad_alloc();
+	return p;
+}
+
+void * operator new[](std::size_t size) throw(std::bad_alloc){
+	return operator new(size);
+}
+
+void operator delete(void * p) throw(){
+	std::free(p);
+}
+
+void operator delete[](void * p) throw(){
+	std::free(p);
+}
+
+#endif /* ALLOCATIONCOUNTER_H_ */
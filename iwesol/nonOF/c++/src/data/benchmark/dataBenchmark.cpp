@@ -0,0 +1,393 @@
+/*---------------------------------------------------------------------------*\
+                               |
+  _____        _______ ____    | IWESOL: IWES Open Library
+ |_ _\ \      / / ____/ ___|   |
+  | | \ \ /\ / /|  _| \___ \   | Copyright: Fraunhofer Institute for Wind
+  | |  \ V  V / | |___ ___) |  | Energy and Energy System Technology IWES
+ |___|  \_/\_/  |_____|____/   |
+                               | http://www.iwes.fraunhofer.de
+                               |
+-------------------------------------------------------------------------------
+License
+    This file is part of IWESOL.
+
+    IWESOL is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IWESOL is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with IWESOL.  If not, see <http://www.gnu.org/licenses/>.
+
+Application
+    dataBenchmark
+
+Description
+    Microbenchmarks of the jlib data library: HashTable, GenericRFunction,
+    Differentiating1D, GenericLinePath and BLIB::d2S, for sizes from 10
+    up to maxSize. Prints ns/op and allocations/op, optionally as CSV.
+
+    Usage: dataBenchmark [-maxSize <n>] [-evals <n>] [-csv <file>]
+
+SourceFiles
+    dataBenchmark.cpp
+
+\*---------------------------------------------------------------------------*/
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <ctime>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <iostream>
+
+#include "HashTable.h"
+#include "GenericRFunction.h"
+#include "GenericLinePath.h"
+#include "BLIB.h"
+#include "AllocationCounter.h"
+
+// * * * * * * * * * * * * * * * * Helpers * * * * * * * * * * * * * * * * * //
+
+namespace {
+
+/// prevents the compiler from discarding results
+volatile double sink = 0;
+
+/// a simple deterministic random number generator in [0,1)
+class Random{
+
+public:
+
+	Random():m_state(12345){}
+
+	inline double operator()(){
+		m_state = m_state * 1103515245UL + 12345UL;
+		return double((m_state >> 16) & 0x7fff) / 32768.;
+	}
+
+private:
+
+	unsigned long m_state;
+};
+
+/// one benchmark result
+struct Result{
+	std::string name;
+	int size;
+	long ops;
+	double nsPerOp;
+	double allocsPerOp;
+};
+
+/// measures time and allocations between start() and stop()
+class Probe{
+
+public:
+
+	inline void start(){
+		m_allocs = allocations;
+		clock_gettime(CLOCK_MONOTONIC, &m_t0);
+	}
+
+	inline Result stop(const std::string & name, int size, long ops){
+		timespec t1;
+		clock_gettime(CLOCK_MONOTONIC, &t1);
+		unsigned long allocs = allocations - m_allocs;
+		Result r;
+		r.name        = name;
+		r.size        = size;
+		r.ops         = ops;
+		r.nsPerOp     = ( ( t1.tv_sec - m_t0.tv_sec ) * 1e9
+				+ ( t1.tv_nsec - m_t0.tv_nsec ) ) / double(ops);
+		r.allocsPerOp = double(allocs) / double(ops);
+		return r;
+	}
+
+private:
+
+	timespec m_t0;
+	unsigned long m_allocs;
+};
+
+/// the number of evaluations per measurement
+long evals = 10000;
+
+/// the number of erase and prepend operations per measurement
+const long EDITS = 10;
+
+/// the test function
+inline double f(const double & x){ return x * x * 0.01 + 3. * x; }
+
+/// a line path with n points
+jlib::GenericLinePath< double > makePath(int n){
+	jlib::GenericLinePath< double > path;
+	for(int i = 0; i < n; i++){
+		path.addPoint(f(i));
+	}
+	return path;
+}
+
+// * * * * * * * * * * * * * * * * Benchmarks  * * * * * * * * * * * * * * * //
+
+void benchHashTable(int n, std::vector< Result > & results){
+
+	Probe p;
+	Random rnd;
+
+	// construction:
+	long reps = n < evals ? evals / n : 1;
+	p.start();
+	for(long r = 0; r < reps; r++){
+		jlib::HashTable< double, double > h;
+		for(int i = 0; i < n; i++){
+			h.set(i, f(i));
+		}
+		sink = sink + h.size();
+	}
+	results.push_back(p.stop("HashTable::set", n, reps * n));
+
+	jlib::HashTable< double, double > h;
+	for(int i = 0; i < n; i++){
+		h.set(i, f(i));
+	}
+
+	// indexed access:
+	std::vector< int > idx(evals);
+	for(long k = 0; k < evals; k++) idx[k] = int(rnd() * n);
+	p.start();
+	double s = 0;
+	for(long k = 0; k < evals; k++){
+		s += h.data(idx[k]) + h.key(idx[k]);
+	}
+	sink = s;
+	results.push_back(p.stop("HashTable::data(i)", n, evals));
+
+	// key lookup:
+	p.start();
+	long is = 0;
+	for(long k = 0; k < evals; k++){
+		is += h.index(idx[k]);
+	}
+	sink = is;
+	results.push_back(p.stop("HashTable::index", n, evals));
+
+	// neighbour search:
+	p.start();
+	is = 0;
+	for(long k = 0; k < evals; k++){
+		is += h.firstGreaterEqualKeyIndex(idx[k] + 0.5);
+	}
+	sink = is;
+	results.push_back(p.stop("HashTable::firstGreaterEqualKeyIndex", n, evals));
+}
+
+void benchRFunction(int n, std::vector< Result > & results){
+
+	Probe p;
+	Random rnd;
+
+	// construction:
+	long reps = n < evals ? evals / n : 1;
+	p.start();
+	for(long r = 0; r < reps; r++){
+		jlib::GenericRFunction< double > g;
+		for(int i = 0; i < n; i++){
+			g.add(i, f(i));
+		}
+		sink = sink + g.size();
+	}
+	results.push_back(p.stop("GenericRFunction::add", n, reps * n));
+
+	jlib::GenericRFunction< double > g;
+	for(int i = 0; i < n; i++){
+		g.add(i, f(i));
+	}
+	std::vector< double > xs(evals);
+	for(long k = 0; k < evals; k++) xs[k] = rnd() * ( n - 1 );
+
+	// interpolation:
+	p.start();
+	double s = 0;
+	for(long k = 0; k < evals; k++){
+		s += g[xs[k]];
+	}
+	sink = s;
+	results.push_back(p.stop("GenericRFunction::operator[]", n, evals));
+
+	// derivatives:
+	for(int m = 1; m <= 2; m++){
+		p.start();
+		s = 0;
+		for(long k = 0; k < evals; k++){
+			s += g.derivative(xs[k], m);
+		}
+		sink = s;
+		results.push_back(p.stop
+		(
+				m == 1 ? "Differentiating1D::derivative(x,1)" : "Differentiating1D::derivative(x,2)",
+				n,
+				evals
+		));
+	}
+}
+
+void benchLinePath(int n, std::vector< Result > & results){
+
+	Probe p;
+	Random rnd;
+
+	// construction:
+	long reps = n < evals ? evals / n : 1;
+	p.start();
+	for(long r = 0; r < reps; r++){
+		sink = sink + makePath(n).points();
+	}
+	results.push_back(p.stop("GenericLinePath::addPoint", n, reps * n));
+
+	jlib::GenericLinePath< double > path = makePath(n);
+	std::vector< double > ss(evals);
+	for(long k = 0; k < evals; k++) ss[k] = rnd();
+
+	// indexed access:
+	std::vector< int > idx(evals);
+	for(long k = 0; k < evals; k++) idx[k] = int(ss[k] * n);
+	p.start();
+	double s = 0;
+	for(long k = 0; k < evals; k++){
+		s += path.getPoint(idx[k]);
+	}
+	sink = s;
+	results.push_back(p.stop("GenericLinePath::getPoint", n, evals));
+
+	// interpolation:
+	p.start();
+	s = 0;
+	for(long k = 0; k < evals; k++){
+		s += path[ss[k]];
+	}
+	sink = s;
+	results.push_back(p.stop("GenericLinePath::operator[]", n, evals));
+
+	// tangents:
+	p.start();
+	s = 0;
+	for(long k = 0; k < evals; k++){
+		s += path.getTangent(ss[k]);
+	}
+	sink = s;
+	results.push_back(p.stop("GenericLinePath::getTangent", n, evals));
+
+	// erase, on a copy:
+	if(n > EDITS){
+		jlib::GenericLinePath< double > epath = path;
+		p.start();
+		for(long k = 0; k < EDITS; k++){
+			epath.erase(epath.points() / 2);
+		}
+		sink = epath.points();
+		results.push_back(p.stop("GenericLinePath::erase", n, EDITS));
+	} else {
+		std::printf
+		(
+				"GenericLinePath::erase skipped for size %d, needs more than %ld points\n",
+				n, EDITS
+		);
+	}
+
+	// prepend, on a copy:
+	jlib::GenericLinePath< double > ppath = path;
+	p.start();
+	for(long k = 0; k < EDITS; k++){
+		ppath.prepend(-k - 1.);
+	}
+	sink = ppath.points();
+	results.push_back(p.stop("GenericLinePath::prepend", n, EDITS));
+}
+
+void benchD2S(std::vector< Result > & results){
+
+	Probe p;
+	Random rnd;
+
+	std::vector< double > xs(evals);
+	for(long k = 0; k < evals; k++) xs[k] = ( rnd() - 0.5 ) * 2e4;
+
+	p.start();
+	long s = 0;
+	for(long k = 0; k < evals; k++){
+		s += jlib::BLIB::d2S(xs[k]).size();
+	}
+	sink = s;
+	results.push_back(p.stop("BLIB::d2S", 0, evals));
+}
+
+} // End anonymous namespace
+
+// * * * * * * * * * * * * * * * * Main  * * * * * * * * * * * * * * * * * * //
+
+int main(int argc, char * argv[]){
+
+	// read arguments:
+	int maxSize = 100000;
+	std::string csvFile;
+	for(int i = 1; i < argc; i++){
+		if(std::strcmp(argv[i], "-maxSize") == 0 && i + 1 < argc){
+			maxSize = std::atoi(argv[++i]);
+		} else if(std::strcmp(argv[i], "-evals") == 0 && i + 1 < argc){
+			evals = std::atol(argv[++i]);
+		} else if(std::strcmp(argv[i], "-csv") == 0 && i + 1 < argc){
+			csvFile = argv[++i];
+		} else {
+			std::cerr << "Usage: " << argv[0] << " [-maxSize <n>] [-evals <n>] [-csv <file>]" << std::endl;
+			return 1;
+		}
+	}
+
+	// run:
+	std::vector< Result > results;
+	for(int n = 10; n <= maxSize; n *= 10){
+		benchHashTable(n, results);
+		benchRFunction(n, results);
+		benchLinePath(n, results);
+	}
+	benchD2S(results);
+
+	// print:
+	std::printf("%-40s %8s %10s %12s %12s\n", "benchmark", "size", "ops", "ns/op", "allocs/op");
+	for(unsigned int i = 0; i < results.size(); i++){
+		const Result & r = results[i];
+		std::printf
+		(
+				"%-40s %8d %10ld %12.1f %12.2f\n",
+				r.name.c_str(), r.size, r.ops, r.nsPerOp, r.allocsPerOp
+		);
+	}
+
+	// write csv:
+	if(!csvFile.empty()){
+		std::ofstream csv(csvFile.c_str());
+		if(!csv){
+			std::cerr << "dataBenchmark: cannot open '" << csvFile << "'" << std::endl;
+			return 1;
+		}
+		csv << "benchmark,size,ops,nsPerOp,allocsPerOp\n";
+		for(unsigned int i = 0; i < results.size(); i++){
+			const Result & r = results[i];
+			csv << r.name << "," << r.size << "," << r.ops << ","
+				<< r.nsPerOp << "," << r.allocsPerOp << "\n";
+		}
+	}
+
+	return 0;
+}
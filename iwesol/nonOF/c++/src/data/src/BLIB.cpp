@@ -34,6 +34,7 @@ References
 
 \*---------------------------------------------------------------------------*/
 #include "BLIB.h"
+#include "NumberFormat.h"
 
 #include <ctime>
 #include <cstdlib>
@@ -208,15 +209,17 @@ int boxPyramid_height(const int baseboxes, const int column){
 }
 
 String d2S(double d, int imax, const std::string & zeroFill){
-	String key("");
-	double x = chop(d);
-	String st(x);
-	for(int i = 0; i < imax; i++){
-		if( i < (int)st.size()){
-			key += jlib::String(st[i]);
-		} else {
-			key += zeroFill;
-		}
+	char st[NumberFormat::BUFFER_SIZE];
+	int n = NumberFormat::formatGeneral(chop(d), st);
+	String key;
+	if(imax <= n){
+		key.assign(st, imax > 0 ? imax : 0);
+		return key;
+	}
+	key.reserve(n + ( imax - n ) * zeroFill.size());
+	key.assign(st, n);
+	for(int i = n; i < imax; i++){
+		key += zeroFill;
 	}
 	return key;
 }
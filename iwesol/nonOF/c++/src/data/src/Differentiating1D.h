@@ -46,6 +46,58 @@ References
 
 namespace jlib {
 
+/**
+ * @class jlib::StencilKernel
+ * @brief Evaluates sum_i w_i * f_i for compile-time sized derivative stencils.
+ *
+ * The generic kernel is disabled, such that Differentiating1D keeps the
+ * run-time sized Fornberg scheme for arbitrary Data. Specialisations set
+ * 'enabled' and provide a sum the compiler can vectorise, see below for
+ * double and PointStencilKernel.H for Foam::vector.
+ */
+template< class Data >
+struct StencilKernel{
+
+	/// switches the fixed-size evaluation on or off
+	static const bool enabled = false;
+
+	/// returns sum_{i < n} w[i] * d[i], with n <= N
+	template< int N >
+	static inline Data sum(
+			const double * w,
+			const Data * const * d,
+			int n
+			){
+		Data out = w[0] * (*d[0]);
+		for(int i = 1; i < n; i++) out += w[i] * (*d[i]);
+		return out;
+	}
+};
+
+/**
+ * @class jlib::StencilKernel< double >
+ * @brief The compile-time sized stencil sum for scalar data, such that
+ * GenericRFunction< double > evaluates without heap allocation.
+ */
+template<>
+struct StencilKernel< double >{
+
+	/// switches the fixed-size evaluation on
+	static const bool enabled = true;
+
+	/// returns sum_{i < n} w[i] * d[i], with n <= N
+	template< int N >
+	static inline double sum(
+			const double * w,
+			const double * const * d,
+			int n
+			){
+		double out = 0;
+		for(int i = 0; i < n; i++) out += w[i] * (*d[i]);
+		return out;
+	}
+};
+
 /**
  * @class Differentiating1D
  * @brief An interface for classes that are differentiable on arbitrary spaced 1D points.
@@ -58,6 +110,15 @@ class Differentiating1D:
 
 public:
 
+	/// the interpolation schemes: Fornberg/Lagrange of interpolOrder, or cubic Hermite
+	static const int LAGRANGE = 0, HERMITE = 1;
+
+	/// the largest order with a compile-time sized Lagrange kernel
+	static const int MAX_FIXED_ORDER = 6;
+
+	/// the highest derivative handled by the compile-time sized kernels
+	static const int MAX_FIXED_DERIVATIVE = 2;
+
 	/// Constructor.
 	Differentiating1D(
 			int interpolOrder = 4
@@ -75,6 +136,12 @@ public:
 	/// returns the interpolation order
 	inline int interpolOrder() const { return m_interpolOrder; }
 
+	/// set interpolation scheme, LAGRANGE or HERMITE
+	inline void setInterpolScheme(int scheme) { m_interpolScheme = scheme; }
+
+	/// returns the interpolation scheme
+	inline int interpolScheme() const { return m_interpolScheme; }
+
 	/// returns the point range
 	inline const double & pointRange() const { return period(); }
 
@@ -103,6 +170,40 @@ private:
 	/// the interpolation order
 	int m_interpolOrder;
 
+	/// the interpolation scheme
+	int m_interpolScheme;
+
+	/// the generic Lagrange derivative, run-time sized
+	Data derivativeGeneric(const double & x, int m) const;
+
+	/** The Lagrange derivative on a stencil of compile-time maximal size,
+	 * for Data with enabled StencilKernel. No heap allocation, unlike the
+	 * string keyed coefficient table of derivativeGeneric.
+	 */
+	template< int Order >
+	Data derivativeFixed(const double & x, int m) const;
+
+	/// the cubic Hermite derivative, m <= 2
+	Data derivativeHermite(const double & x, int m) const;
+
+	/// the Hermite slope at grid point i, from the neighbouring points
+	Data hermiteSlope(int i) const;
+
+	/** Calculates the Fornberg weights c[k * N + j] of the k-th derivative, k <= m,
+	 * at x0 for the n points xs. The array c has size (m + 1) * N.
+	 */
+	template< int N >
+	static void calcWeights(
+			const double & x0,
+			const double * xs,
+			int n,
+			int m,
+			double * c
+			);
+
+	/// returns the size of the nearby point intervall, and the left point index iL
+	int nearbyPointIntervallSize(const double & x, int m, int & iL, bool & onPoint) const;
+
 	/** Returns the derivative coefficients delta(m,n,i) for m-th derivative at x0, a la
 	 * http://amath.colorado.edu/faculty/fornberg/Docs/MathComp_88_FD_formulas.pdf
 	 * The m-th derivative is
@@ -143,6 +244,9 @@ private:
 	/// defines the point interval
 	void getPointIntervall(std::vector<int> & intervall, int iL, int iR) const;
 
+	/// defines the point interval, for an array of given size
+	void getPointIntervall(int * intervall, int outSize, int iL, int iR) const;
+
 	/// finds x position of point, including periodicity
 	double findXPeriodic(int oin) const;
 };
@@ -152,15 +256,52 @@ Differentiating1D< Data >::Differentiating1D(
 			int interpolOrder
 			):
 			Periodic(),
-			m_interpolOrder(interpolOrder){
+			m_interpolOrder(interpolOrder),
+			m_interpolScheme(LAGRANGE){
 }
 
+template< class Data >
+const int Differentiating1D< Data >::LAGRANGE;
+
+template< class Data >
+const int Differentiating1D< Data >::HERMITE;
+
+template< class Data >
+const int Differentiating1D< Data >::MAX_FIXED_ORDER;
+
+template< class Data >
+const int Differentiating1D< Data >::MAX_FIXED_DERIVATIVE;
+
 template< class Data >
 Data Differentiating1D< Data >::derivative(const double & x0, int m) const{
 
+	// cubic Hermite:
+	if(m_interpolScheme == HERMITE){
+		assert( m >= 0 && m <= 2 && hashTable().size() > 1 );
+		return derivativeHermite(x0,m);
+	}
+
 	// check derivative request:
 	assert( m >= 0 && m <= highestDerivative() );
 
+	// compile-time sized stencils:
+	if(StencilKernel< Data >::enabled && m <= MAX_FIXED_DERIVATIVE){
+		switch(m_interpolOrder){
+			case 1: return derivativeFixed< 1 >(x0,m);
+			case 2: return derivativeFixed< 2 >(x0,m);
+			case 3: return derivativeFixed< 3 >(x0,m);
+			case 4: return derivativeFixed< 4 >(x0,m);
+			case 5: return derivativeFixed< 5 >(x0,m);
+			case 6: return derivativeFixed< 6 >(x0,m);
+		}
+	}
+
+	return derivativeGeneric(x0,m);
+}
+
+template< class Data >
+Data Differentiating1D< Data >::derivativeGeneric(const double & x0, int m) const{
+
 	// prepare:
 	double x                                = modx(x0);
 	std::vector< int > oi                   = getNearbyPointIntervall(x,m);
@@ -168,16 +309,217 @@ Data Differentiating1D< Data >::derivative(const double & x0, int m) const{
 	unsigned int n                          = oi.size() - 1;
 
 	// first point:
-	Data out = coeffs[key(x,m,n,0,m_interpolOrder)] * hashTable().data(oi[0]);
+	Data out = coeffs[key(x,m,n,0,m_interpolOrder)] * hashTable().data(modi(oi[0]));
 
 	// remaining points of domain:
 	for(unsigned int i = 1; i <= n; i++){
-		out += coeffs[key(x,m,n,i,m_interpolOrder)] * hashTable().data(oi[i]);
+		out += coeffs[key(x,m,n,i,m_interpolOrder)] * hashTable().data(modi(oi[i]));
 	}
 
 	return out;
 }
 
+template< class Data >
+template< int Order >
+Data Differentiating1D< Data >::derivativeFixed(const double & x0, int m) const{
+
+	// stencil capacity:
+	const int N = Order + MAX_FIXED_DERIVATIVE;
+
+	// find stencil:
+	double x     = modx(x0);
+	int iL       = -1;
+	bool onPoint = false;
+	int n        = nearbyPointIntervallSize(x,m,iL,onPoint);
+	int oi[N];
+	if(onPoint){
+		getPointIntervall(oi,n,iL,iL);
+	} else {
+		getPointIntervall(oi,n,iL,iL + 1);
+	}
+
+	// collect stencil points and data:
+	double xs[N] = { 0 };
+	const Data * ds[N];
+	for(int i = 0; i < n; i++){
+		xs[i] = findXPeriodic(oi[i]);
+		ds[i] = &hashTable().data(modi(oi[i]));
+	}
+
+	// calculate weights:
+	double c[(MAX_FIXED_DERIVATIVE + 1) * N];
+	calcWeights< N >(x,xs,n,m,c);
+
+	return StencilKernel< Data >::template sum< N >(&c[m * N],ds,n);
+}
+
+template< class Data >
+template< int N >
+void Differentiating1D< Data >::calcWeights(
+		const double & x0,
+		const double * xs,
+		int n,
+		int m,
+		double * c
+		){
+
+	// init:
+	for(int k = 0; k <= m; k++){
+		for(int j = 0; j < n; j++){
+			c[k * N + j] = 0;
+		}
+	}
+	c[0]      = 1.;
+	double c1 = 1.;
+	double c4 = xs[0] - x0;
+
+	// Fornberg recursion:
+	for(int i = 1; i < n; i++){
+
+		int mn    = i < m ? i : m;
+		double c2 = 1.;
+		double c5 = c4;
+		c4        = xs[i] - x0;
+
+		for(int j = 0; j < i; j++){
+
+			double c3 = xs[i] - xs[j];
+			c2       *= c3;
+
+			// new point:
+			if(j == i - 1){
+				for(int k = mn; k > 0; k--){
+					c[k * N + i] = c1 * ( k * c[(k - 1) * N + i - 1] - c5 * c[k * N + i - 1] ) / c2;
+				}
+				c[i] = -c1 * c5 * c[i - 1] / c2;
+			}
+
+			// update old points:
+			for(int k = mn; k > 0; k--){
+				c[k * N + j] = ( c4 * c[k * N + j] - k * c[(k - 1) * N + j] ) / c3;
+			}
+			c[j] = c4 * c[j] / c3;
+		}
+
+		c1 = c2;
+	}
+}
+
+template< class Data >
+Data Differentiating1D< Data >::derivativeHermite(const double & x0, int m) const{
+
+	// find intervall:
+	double x = modx(x0);
+	int s    = hashTable().size();
+	int iL   = hashTable().lastLessEqualKeyIndex(x);
+	if(iL < 0) iL = 0;
+	if(!periodic() && iL > s - 2) iL = s - 2;
+	int iR   = iL + 1;
+
+	// prepare:
+	double xL     = findXPeriodic(iL);
+	double h      = findXPeriodic(iR) - xL;
+	double t      = (x - xL) / h;
+	const Data & fL = hashTable().data(iL);
+	const Data & fR = hashTable().data(modi(iR));
+	Data dL         = hermiteSlope(iL);
+	Data dR         = hermiteSlope(iR);
+
+	// value:
+	if(m == 0){
+		double t2 = t * t;
+		double t3 = t2 * t;
+		return ( 2 * t3 - 3 * t2 + 1 ) * fL + ( -2 * t3 + 3 * t2 ) * fR
+				+ h * ( ( t3 - 2 * t2 + t ) * dL + ( t3 - t2 ) * dR );
+	}
+
+	// first derivative:
+	if(m == 1){
+		double t2 = t * t;
+		return ( ( 6 * t2 - 6 * t ) / h ) * ( fL - fR )
+				+ ( 3 * t2 - 4 * t + 1 ) * dL + ( 3 * t2 - 2 * t ) * dR;
+	}
+
+	// second derivative:
+	return ( ( 12 * t - 6 ) / ( h * h ) ) * ( fL - fR )
+			+ ( ( 6 * t - 4 ) / h ) * dL + ( ( 6 * t - 2 ) / h ) * dR;
+}
+
+template< class Data >
+Data Differentiating1D< Data >::hermiteSlope(int i) const{
+
+	// prepare:
+	int s = hashTable().size();
+
+	// one-sided at non-periodic ends:
+	if(!periodic() && (s == 2 || i == 0)){
+		return ( hashTable().data(1) - hashTable().data(0) )
+				/ ( hashTable().key(1) - hashTable().key(0) );
+	}
+	if(!periodic() && i == s - 1){
+		return ( hashTable().data(s - 1) - hashTable().data(s - 2) )
+				/ ( hashTable().key(s - 1) - hashTable().key(s - 2) );
+	}
+
+	// three-point formula on non-uniform grid:
+	double x0 = findXPeriodic(i - 1);
+	double x1 = findXPeriodic(i);
+	double x2 = findXPeriodic(i + 1);
+	double hl = x1 - x0;
+	double hr = x2 - x1;
+	return ( -hr / ( hl * ( hl + hr ) ) ) * hashTable().data(modi(i - 1))
+			+ ( ( hr - hl ) / ( hl * hr ) ) * hashTable().data(modi(i))
+			+ ( hl / ( hr * ( hl + hr ) ) ) * hashTable().data(modi(i + 1));
+}
+
+template< class Data >
+int Differentiating1D< Data >::nearbyPointIntervallSize(
+		const double & x,
+		int m,
+		int & iL,
+		bool & onPoint
+		) const{
+
+	// check if point is listed:
+	iL      = hashTable().lastLessEqualKeyIndex(x);
+	onPoint = iL >= 0 && hashTable().key(iL) == x;
+	int outSize = m + m_interpolOrder;
+
+	// case grid point, non-periodic:
+	if(onPoint && !periodic()){
+		if(outSize % 2 == 0){
+			int osq = outSize / 2 - 1;
+			if(iL - osq >= 0 && iL + osq < int(hashTable().size())){
+				outSize--;
+			}
+		}
+	}
+
+	// case grid point, periodic:
+	else if(onPoint){
+		if(outSize % 2 == 0){
+			outSize--;
+		}
+	}
+
+	// case between grid points, non-periodic:
+	else if(!periodic()){
+		if(outSize % 2 == 1){
+			int osq = (outSize - 1) / 2 - 1;
+			if(iL - osq >= 0 && iL + 1 + osq < int(hashTable().size())){
+				outSize--;
+			}
+		}
+	}
+
+	// case between grid points, periodic:
+	else if(outSize % 2 == 1){
+		outSize--;
+	}
+
+	return outSize;
+}
+
 template< class Data >
 std::vector< int > Differentiating1D< Data >::getNearbyPointIntervall(
 		const double & x0,
@@ -279,10 +621,19 @@ void Differentiating1D< Data >::getPointIntervall(
 		int iL,
 		int iR
 		) const{
+	if(!intervall.empty()) getPointIntervall(&intervall[0],int(intervall.size()),iL,iR);
+}
+
+template< class Data >
+void Differentiating1D< Data >::getPointIntervall(
+		int * intervall,
+		int outSize,
+		int iL,
+		int iR
+		) const{
 
 	// prepare:
-	std::vector< int > & out = intervall;
-	int outSize         = int(out.size());
+	int * out           = intervall;
 	int il              = 0;
 	int ir              = 0;
 
@@ -403,7 +754,7 @@ double Differentiating1D< Data >::findXPeriodic(
 
 	// right shift:
 	if(perdiff > 0) {
-		xn = hashTable().lastKey() + periodicStep() + hashTable().toc()[oin];
+		xn = hashTable().toc()[modi(oin)] + ( perdiff / int(hashTable().size()) ) * period();
 	}
 
 	// left shift:
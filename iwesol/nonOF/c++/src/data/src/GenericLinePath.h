@@ -53,6 +53,9 @@ namespace jlib {
  *
  * Note: A function 'double operator()(const Data & A,const Data & B) const' must
  * be provided by the class DataDist
+ *
+ * As for GenericRFunction, the const members are read-only and may be called
+ * concurrently on the same path, e.g. for parallel spline sampling.
  */
 template < class Data, class DataDist = Distance< Data > >
 class GenericLinePath:
@@ -503,7 +506,7 @@ void GenericLinePath< Data, DataDist >::erase(int i){
 
 	// erase points:
 	for(unsigned int j = 0; j <= pts.size(); j++){
-		GenericRFunction< Data >::erase(getPointL(i + j));
+		GenericRFunction< Data >::erase(getPointL(i));
 	}
 
 	// re-insert higher points:
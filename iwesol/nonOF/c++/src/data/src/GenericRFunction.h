@@ -46,6 +46,10 @@ namespace jlib {
  * @class jlib::GenericRFunction
  * @brief A differentiable function f: R -> Data
  *
+ * Evaluation (operator[], derivative) and all other const member functions
+ * do not modify the object, so one function can be evaluated from several
+ * threads at once. Adding, erasing or shifting points must not run
+ * concurrently with evaluation.
  */
 
 template < class Data >
@@ -105,7 +109,7 @@ public:
 	inline void add(const double & xval, const Data & yval);
 
 	/// erase a point
-	inline void erase(const double & xval) { m_data.erase(xval); Differentiating1D< Data >::update(); }
+	inline void erase(const double & xval) { m_data.erase(xval); this->update(); }
 
 	/// check if empty
 	inline bool empty() const { return m_data.empty(); }
@@ -168,7 +172,7 @@ inline void GenericRFunction< Data >::add(
 		const Data & yval
 		) {
 	m_data.set(xval,yval);
-	Differentiating1D< Data >::update();
+	this->update();
 }
 
 template < class Data >
@@ -194,7 +198,7 @@ GenericRFunction< Data > & GenericRFunction< Data >::operator=(
 	if(this != &rhs){
 		m_data = rhs.m_data;
 		m_name = rhs.m_name;
-		if(!empty()) Differentiating1D< Data >::update();
+		if(!empty()) this->update();
 	}
 	return *this;
 }
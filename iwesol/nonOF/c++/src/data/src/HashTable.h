@@ -50,6 +50,11 @@ namespace jlib{
  *
  * Class Comp needs a method 'bool operator()(const Key & A, const Key & B) const'
  * ordering the keys.
+ *
+ * The ordered key list and the index addressing are updated by set, erase
+ * and clear. All const member functions are read-only, so concurrent calls
+ * of const members on the same object from several threads are safe, as long
+ * as no thread modifies the table at the same time.
  */
 template < class Data, class Key, class Comp = std::less< Key > >
 class HashTable{
@@ -65,6 +70,9 @@ public:
 			const std::vector< Data > & data
 			);
 
+	/// Copy constructor.
+	HashTable(const HashTable< Data, Key, Comp > & rhs);
+
 	/// set an element
 	inline void set(
 			const Key & key,
@@ -88,7 +96,7 @@ public:
 	inline bool empty() const { return m_map.empty(); }
 
 	/// return the list of keys
-	inline const std::vector< Key > & toc() const;
+	inline const std::vector< Key > & toc() const { return m_toc; }
 
 	/// returns the index of a key in the toc list
 	inline int index(const Key & key) const;
@@ -97,7 +105,7 @@ public:
 	inline const Key & key(int i) const { return toc()[i]; }
 
 	/// returns data
-	inline const Data & data(int i) const { return (*this)[key(i)]; }
+	inline const Data & data(int i) const { return *m_dataPtr[i]; }
 
 	/// checks if key is first in list
 	inline bool isFirst(const Key & key) const { return index(key) == 0; }
@@ -160,7 +168,7 @@ public:
 	inline int lastLessKeyIndex(const Key & key) const;
 
 	/// clear content
-	inline void clear() { m_map.clear(); m_toc.clear(); m_indexMap.clear(); }
+	inline void clear() { m_map.clear(); m_toc.clear(); m_dataPtr.clear(); }
 
 	// returns an element
 	inline Data & operator[](const Key & key);
@@ -168,17 +176,26 @@ public:
 	// returns an element
 	inline const Data & operator[](const Key & key) const;
 
+	/// assignment operator
+	HashTable< Data, Key, Comp > & operator=(const HashTable< Data, Key, Comp > & rhs);
+
 
 private:
 
 	/// the underlying map
 	std::map< Key, Data , Comp > m_map;
 
-	/// the key list
-	mutable std::vector< Key > m_toc;
+	/// the ordered key list
+	std::vector< Key > m_toc;
 
-	/// the order list
-	mutable std::map< Key, int , Comp > m_indexMap;
+	/// pointers to the map data, in key order
+	std::vector< Data * > m_dataPtr;
+
+	/// rebuilds key list and data pointers from the map
+	void rebuild();
+
+	/// returns position of key in the key list, as lower_bound
+	inline int tocPosition(const Key & key) const;
 };
 
 template < class Data, class Key, class Comp >
@@ -187,8 +204,54 @@ HashTable< Data, Key, Comp >::HashTable(
 			const std::vector< Data > & data
 			){
 	for(unsigned int i = 0; i < keys.size(); i++){
-		set(keys[i],data[i]);
+		m_map.insert
+		(
+				typename std::map< Key, Data, Comp >::value_type
+				(
+						keys[i],
+						data[i]
+				)
+		);
 	}
+	rebuild();
+}
+
+template < class Data, class Key, class Comp >
+HashTable< Data, Key, Comp >::HashTable(
+			const HashTable< Data, Key, Comp > & rhs
+			):
+			m_map(rhs.m_map){
+	rebuild();
+}
+
+template < class Data, class Key, class Comp >
+HashTable< Data, Key, Comp > & HashTable< Data, Key, Comp >::operator=(
+			const HashTable< Data, Key, Comp > & rhs
+			){
+	if(this != &rhs){
+		m_map = rhs.m_map;
+		rebuild();
+	}
+	return *this;
+}
+
+template < class Data, class Key, class Comp >
+void HashTable< Data, Key, Comp >::rebuild(){
+	m_toc.resize(m_map.size());
+	m_dataPtr.resize(m_map.size());
+	int counter = 0;
+	for(typename std::map< Key, Data, Comp >::iterator it = m_map.begin(); it != m_map.end(); ++it){
+		  m_toc[counter]     = it->first;
+		  m_dataPtr[counter] = &(it->second);
+		  counter++;
+	}
+}
+
+template < class Data, class Key, class Comp >
+inline int HashTable< Data, Key, Comp >::tocPosition(
+		const Key & key
+		) const{
+	return std::lower_bound(m_toc.begin(), m_toc.end(), key, Comp()) - m_toc.begin();
 }
 
 template < class Data, class Key, class Comp >
@@ -196,7 +259,9 @@ inline void HashTable< Data, Key, Comp >::set(
 			const Key & key,
 			const Data & data
 			){
-	m_map.insert
+
+	// insert, existing keys are kept:
+	std::pair< typename std::map< Key, Data, Comp >::iterator, bool > res = m_map.insert
 	(
 			typename std::map< Key, Data, Comp >::value_type
 			(
@@ -204,6 +269,12 @@ inline void HashTable< Data, Key, Comp >::set(
 					data
 			)
 	);
+	if(!res.second) return;
+
+	// update key list and data pointers:
+	int pos = tocPosition(key);
+	m_toc.insert(m_toc.begin() + pos, key);
+	m_dataPtr.insert(m_dataPtr.begin() + pos, &(res.first->second));
 }
 
 template < class Data, class Key, class Comp >
@@ -224,56 +295,19 @@ template < class Data, class Key, class Comp >
 void HashTable< Data, Key, Comp >::erase(
 			const Key & key
 			) {
-	m_map.erase(key);
-	if(m_indexMap.count(key)){
-		typename std::vector< Key >::iterator it = std::find(m_toc.begin(), m_toc.end(), key);
-		while(++it != m_toc.end()){
-			m_indexMap[*it]--;
-		}
-		m_indexMap.erase(key);
-	}
-	if(m_toc.size() > 0){
-		m_toc.erase
-		(
-				std::find(m_toc.begin(), m_toc.end(), key)
-		);
-	}
-}
-
-
-template < class Data, class Key, class Comp >
-inline const std::vector< Key > & HashTable< Data, Key, Comp >::toc() const{
-	if(m_toc.size() == size()) return m_toc;
-	m_toc.resize(size());
-	int counter = 0;
-	for(typename std::map< Key, Data, Comp >::const_iterator it = m_map.begin(); it != m_map.end(); ++it){
-		  m_toc[counter] = it->first;
-		  counter++;
-	}
-	return m_toc;
+	if(!m_map.erase(key)) return;
+	int pos = tocPosition(key);
+	m_toc.erase(m_toc.begin() + pos);
+	m_dataPtr.erase(m_dataPtr.begin() + pos);
 }
 
 template < class Data, class Key, class Comp >
 inline int HashTable< Data, Key, Comp >::index(
 		const Key & key
 		) const{
-	if(m_indexMap.size() != size()) {
-		m_indexMap.clear();
-		int counter = 0;
-		for(typename std::map< Key, Data, Comp >::const_iterator it = m_map.begin(); it != m_map.end(); ++it){
-			  m_indexMap.insert
-			  (
-					  typename std::map< Key, int, Comp >::value_type
-					  (
-							  it->first,
-							  counter
-					  )
-			  );
-			  counter++;
-		}
-	}
-	if(m_indexMap.count(key)){
-		return m_indexMap[key];
+	int pos = tocPosition(key);
+	if(pos < int(m_toc.size()) && !Comp()(key, m_toc[pos])){
+		return pos;
 	}
 	return -1;
 }
@@ -318,38 +352,30 @@ template < class Data, class Key, class Comp >
 inline int HashTable< Data, Key, Comp >::firstGreaterEqualKeyIndex(
 		const Key & key
 		) const {
-	typename std::map< Key, Data, Comp >::const_iterator it = m_map.lower_bound(key);
-	if(it == m_map.end()) return -1;
-	return index(it->first);
+	int pos = tocPosition(key);
+	return pos < int(m_toc.size()) ? pos : -1;
 }
 
 template < class Data, class Key, class Comp >
 inline int HashTable< Data, Key, Comp >::firstGreaterKeyIndex(
 		const Key & key
 		) const {
-	typename std::map< Key, Data, Comp >::const_iterator it = m_map.lower_bound(key);
-	if(it == m_map.end()) return -1;
-	return index(it->first);
+	int pos = tocPosition(key);
+	return pos < int(m_toc.size()) ? pos : -1;
 }
 
 template < class Data, class Key, class Comp >
 inline int HashTable< Data, Key, Comp >::lastLessEqualKeyIndex(
 		const Key & key
 		) const {
-	typename std::map< Key, Data, Comp >::const_iterator it  = m_map.upper_bound(key);
-	if(it == m_map.begin()) return -1;
-	it--;
-	return index(it->first);
+	return int(std::upper_bound(m_toc.begin(), m_toc.end(), key, Comp()) - m_toc.begin()) - 1;
 }
 
 template < class Data, class Key, class Comp >
 inline int HashTable< Data, Key, Comp >::lastLessKeyIndex(
 		const Key & key
 		) const {
-	typename std::map< Key, Data, Comp >::const_iterator it  = m_map.lower_bound(key);
-	if(it == m_map.begin()) return -1;
-	it--;
-	return index(it->first);
+	return tocPosition(key) - 1;
 }
 
 }
@@ -79,8 +79,9 @@ public:
 	/// applies modulo operation, if periodic
 	inline double modx(const double & x) const;
 
-	/// updates the period
-	inline void update();
+	/// updates the period, called after every change of the points.
+	/// Derived classes extend it to drop data derived from the points.
+	virtual void update();
 
 
 private:
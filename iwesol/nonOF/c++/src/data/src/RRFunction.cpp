@@ -34,6 +34,8 @@ References
 
 \*---------------------------------------------------------------------------*/
 
+#include <cmath>
+
 #include "RRFunction.h"
 
 namespace jlib {
@@ -47,7 +49,9 @@ RRFunction::RRFunction(
 				interpolOrder,
 				name
 		),
-		m_plotPoints(0){
+		m_plotPoints(0),
+		m_frozenX0(0),
+		m_frozenInvDx(0){
 }
 
 RRFunction::RRFunction(
@@ -63,7 +67,9 @@ RRFunction::RRFunction(
 				interpolOrder,
 				name
 		),
-		m_plotPoints(0){
+		m_plotPoints(0),
+		m_frozenX0(0),
+		m_frozenInvDx(0){
 }
 
 std::vector< double > RRFunction::getPlotColumn(int i) const{
@@ -99,4 +105,69 @@ std::vector< double > RRFunction::getPlotColumn(int i) const{
 	return out;
 }
 
+double RRFunction::freeze(int samples){
+
+	unfreeze();
+	if(size() < 2) return 0;
+	if(samples < 4) samples = 4;
+
+	// resample:
+	double dx = periodic() ?
+			period() / double(samples) :
+			( lastPoint() - firstPoint() ) / double(samples - 1);
+	std::vector< double > f(samples);
+	for(int i = 0; i < samples; i++){
+		f[i] = GenericRFunction< double >::operator[](firstPoint() + i * dx);
+	}
+	m_frozen.swap(f);
+	m_frozenX0    = firstPoint();
+	m_frozenInvDx = 1. / dx;
+
+	// estimate resampling error at cell centres:
+	int cells = periodic() ? samples : samples - 1;
+	double err = 0;
+	for(int i = 0; i < cells; i++){
+		double x = m_frozenX0 + ( i + 0.5 ) * dx;
+		double d = std::abs(frozenValue(x) - GenericRFunction< double >::operator[](x));
+		if(d > err) err = d;
+	}
+
+	return err;
+}
+
+double RRFunction::frozenValue(const double & x) const{
+
+	int n = m_frozen.size();
+
+	// outside non-periodic range: extrapolate as usual
+	if(!periodic() && ( x < firstPoint() || x > lastPoint() )){
+		return GenericRFunction< double >::operator[](x);
+	}
+
+	// find the four point stencil:
+	double u = ( modx(x) - m_frozenX0 ) * m_frozenInvDx;
+	int s    = int(u) - 1;
+	if(!periodic()){
+		if(s < 0) s = 0;
+		if(s > n - 4) s = n - 4;
+	}
+	double t = u - s;
+
+	// cubic Lagrange weights at t for nodes 0,1,2,3:
+	double w0 = -( t - 1 ) * ( t - 2 ) * ( t - 3 ) / 6.;
+	double w1 =  t * ( t - 2 ) * ( t - 3 ) / 2.;
+	double w2 = -t * ( t - 1 ) * ( t - 3 ) / 2.;
+	double w3 =  t * ( t - 1 ) * ( t - 2 ) / 6.;
+
+	if(periodic()){
+		int i0 = ( s % n + n ) % n;
+		return w0 * m_frozen[i0]
+		     + w1 * m_frozen[( i0 + 1 ) % n]
+		     + w2 * m_frozen[( i0 + 2 ) % n]
+		     + w3 * m_frozen[( i0 + 3 ) % n];
+	}
+	return w0 * m_frozen[s] + w1 * m_frozen[s + 1]
+	     + w2 * m_frozen[s + 2] + w3 * m_frozen[s + 3];
+}
+
 }
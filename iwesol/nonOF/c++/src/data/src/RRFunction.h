@@ -43,6 +43,14 @@ References
 /**
  * @class jlib::RRFunction
  * @brief A function f: R -> R
+ *
+ * After freeze() the function is evaluated on a uniform resampling of
+ * itself, i.e. by index arithmetic and cubic interpolation instead of the
+ * search and finite difference weights of the original points.
+ * Derivatives are always evaluated on the original points. Any change
+ * of the points or of the periodicity drops the resampling, also through
+ * the GenericRFunction interface. Evaluation through that interface
+ * always uses the original points.
  */
 namespace jlib {
 
@@ -78,13 +86,53 @@ public:
 		/// set number of points in plot. zero = as many as size (default)
 		inline void setPlotPoints(int plotPoints) const { m_plotPoints = plotPoints; }
 
+		/// resamples the function onto a uniform grid of the given size.
+		/// Subsequent evaluations by operator[] use cubic interpolation
+		/// on that grid. Returns the maximal deviation from the original
+		/// interpolation, measured at the grid cell centres.
+		double freeze(int samples);
+
+		/// switches back to interpolation on the original points
+		inline void unfreeze() { m_frozen.clear(); }
+
+		/// checks if the uniform resampling is active
+		inline bool frozen() const { return !m_frozen.empty(); }
+
+		/// returns the interpolated value at x
+		inline double operator[](const double & x) const;
+
+		/// Periodic: updates the period, drops the uniform resampling
+		inline void update();
+
 
 private:
 
 		/// the number of points in plot
 		mutable int m_plotPoints;
+
+		/// the uniformly resampled data, empty if not frozen
+		std::vector< double > m_frozen;
+
+		/// the first point of the uniform grid
+		double m_frozenX0;
+
+		/// the inverse grid spacing of the uniform grid
+		double m_frozenInvDx;
+
+		/// evaluates the cubic interpolation on the uniform grid
+		double frozenValue(const double & x) const;
 };
 
+inline double RRFunction::operator[](const double & x) const{
+	if(!m_frozen.empty()) return frozenValue(x);
+	return GenericRFunction< double >::operator[](x);
+}
+
+inline void RRFunction::update(){
+	unfreeze();
+	GenericRFunction< double >::update();
+}
+
 inline std::string RRFunction::getPlotColumnLabel(int i) const{
 	assert(i >= 0 && i < getPlotColumns());
 	if(i == 0) return "x";
@@ -0,0 +1,324 @@
+/*---------------------------------------------------------------------------*\
+                               |
+  _____        _______ ____    | IWESOL: IWES Open Library
+ |_ _\ \      / / ____/ ___|   |
+  | | \ \ /\ / /|  _| \___ \   | Copyright: Fraunhofer Institute for Wind
+  | |  \ V  V / | |___ ___) |  | Energy and Energy System Technology IWES
+ |___|  \_/\_/  |_____|____/   |
+                               | http://www.iwes.fraunhofer.de
+                               |
+-------------------------------------------------------------------------------
+License
+    This file is part of IWESOL.
+
+    IWESOL is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IWESOL is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with IWESOL.  If not, see <http://www.gnu.org/licenses/>.
+
+Application
+    dataTest
+
+Description
+    Checks of the jlib data library: HashTable invariants, fixed-size
+    against run-time sized derivative stencils, allocation free reads,
+    invalidation of the RRFunction resampling, GenericLinePath::erase,
+    and concurrent evaluation of one GenericLinePath from many threads.
+    The same check for the OpenFOAM PointLinePath is the application
+    Test-PointLinePath of the OF tree.
+
+    Usage: dataTest [-threads <n>]
+
+SourceFiles
+    dataTest.cpp
+
+\*---------------------------------------------------------------------------*/
+
+#include <pthread.h>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <vector>
+#include <string>
+
+#include "HashTable.h"
+#include "GenericRFunction.h"
+#include "GenericLinePath.h"
+#include "RRFunction.h"
+#include "AllocationCounter.h"
+
+// * * * * * * * * * * * * * * * * Run-time sized reference * * * * * * * * //
+
+namespace {
+
+/// a scalar without StencilKernel specialisation, evaluated by the run-time sized scheme
+struct Scalar{
+	double v;
+	Scalar(double a = 0):v(a){}
+	inline Scalar & operator+=(const Scalar & o){ v += o.v; return *this; }
+	inline Scalar operator-() const { return Scalar(-v); }
+};
+
+inline Scalar operator+(const Scalar & a, const Scalar & b){ return Scalar(a.v + b.v); }
+inline Scalar operator-(const Scalar & a, const Scalar & b){ return Scalar(a.v - b.v); }
+inline Scalar operator*(const Scalar & a, const double & b){ return Scalar(a.v * b); }
+inline Scalar operator*(const double & b, const Scalar & a){ return Scalar(a.v * b); }
+inline Scalar operator/(const Scalar & a, const double & b){ return Scalar(a.v / b); }
+
+} // End anonymous namespace
+
+// * * * * * * * * * * * * * * * * Helpers * * * * * * * * * * * * * * * * * //
+
+namespace {
+
+/// the number of failed checks
+int failures = 0;
+
+/// reports a check
+void check(bool ok, const std::string & name){
+	std::printf("%-60s %s\n", name.c_str(), ok ? "passed" : "FAILED");
+	if(!ok) failures++;
+}
+
+/// the test function
+inline double f(const double & x){ return std::cos(0.4 * x) + 0.1 * x; }
+
+/// non-uniformly spaced grid points
+inline double gridPoint(int i){ return i + 0.3 * std::sin(1.7 * i); }
+
+/// a line path with n points
+jlib::GenericLinePath< double > makePath(int n){
+	jlib::GenericLinePath< double > path;
+	for(int i = 0; i < n; i++){
+		path.addPoint(i * i * 0.01 + 3. * i);
+	}
+	return path;
+}
+
+// * * * * * * * * * * * * * * * * Checks  * * * * * * * * * * * * * * * * * //
+
+void testHashTable(){
+
+	jlib::HashTable< double, double > h;
+	for(int i = 0; i < 100; i++){
+		h.set(( i * 37 ) % 100, i);
+	}
+	for(int i = 0; i < 100; i += 3){
+		h.erase(i);
+	}
+
+	bool ok = true;
+	for(unsigned int i = 0; i < h.size(); i++){
+		if(i > 0 && !( h.key(i - 1) < h.key(i) )) ok = false;
+		if(h.index(h.key(i)) != int(i)) ok = false;
+		if(h.data(i) != h[h.key(i)]) ok = false;
+	}
+	check(ok && h.size() == 66, "HashTable: sorted toc, index and data after set/erase");
+}
+
+void testFixedStencils(){
+
+	double maxErr = 0;
+	for(int order = 2; order <= 6; order++){
+		for(int periodic = 0; periodic < 2; periodic++){
+			for(int n = order + 3; n <= 30; n += 9){
+
+				jlib::GenericRFunction< double > g(order);
+				jlib::GenericRFunction< Scalar > r(order);
+				for(int i = 0; i < n; i++){
+					g.add(gridPoint(i), f(gridPoint(i)));
+					r.add(gridPoint(i), Scalar(f(gridPoint(i))));
+				}
+				if(periodic){
+					g.setPeriodic(true);
+					r.setPeriodic(true);
+				}
+
+				for(int m = 0; m <= 2 && m <= g.highestDerivative(); m++){
+					for(double x = g.firstPoint(); x <= g.lastPoint(); x += 0.0173){
+						double a = g.derivative(x, m);
+						double b = r.derivative(x, m).v;
+						double err = std::fabs(a - b) / ( 1 + std::fabs(b) );
+						if(err > maxErr) maxErr = err;
+					}
+				}
+			}
+		}
+	}
+	check(maxErr < 1e-10, "Differentiating1D: fixed-size equals run-time sized stencils");
+}
+
+void testAllocationFree(){
+
+	bool ok = true;
+	for(int order = 2; order <= 6; order++){
+
+		jlib::GenericRFunction< double > g(order);
+		for(int i = 0; i < 50; i++){
+			g.add(gridPoint(i), f(gridPoint(i)));
+		}
+
+		unsigned long a0 = allocations;
+		double s = 0;
+		for(double x = g.firstPoint(); x <= g.lastPoint(); x += 0.01){
+			s += g[x] + g.derivative(x, 1) + g.derivative(x, 2);
+		}
+		if(allocations != a0 || s != s) ok = false;
+	}
+	check(ok, "GenericRFunction: operator[] and derivative(x,m<=2) do not allocate");
+}
+
+void testFrozenUpdate(){
+
+	jlib::RRFunction g;
+	for(int i = 0; i < 20; i++){
+		g.add(gridPoint(i), f(gridPoint(i)));
+	}
+
+	// modify through the base class:
+	bool ok = true;
+	g.freeze(100);
+	jlib::GenericRFunction< double > & base = g;
+	base.add(5.5, 10.);
+	if(g.frozen() || g[5.5] != 10.) ok = false;
+
+	g.freeze(100);
+	base.erase(gridPoint(10));
+	if(g.frozen()) ok = false;
+
+	g.freeze(100);
+	jlib::GenericRFunction< double > h;
+	for(int i = 0; i < 10; i++){
+		h.add(i, 2. * i);
+	}
+	base = h;
+	if(g.frozen() || g[4.] != 8.) ok = false;
+
+	check(ok, "RRFunction: changes through GenericRFunction drop freeze()");
+}
+
+void testLinePathErase(){
+
+	bool ok = true;
+	for(int i = 0; i < 10; i++){
+
+		jlib::GenericLinePath< double > path = makePath(10);
+		path.erase(i);
+
+		// the remaining points, in order:
+		if(path.points() != 9) ok = false;
+		for(int j = 0, k = 0; j < 10 && ok; j++){
+			if(j == i) continue;
+			if(path.getPoint(k++) != j * j * 0.01 + 3. * j) ok = false;
+		}
+	}
+	check(ok, "GenericLinePath: erase(i) removes exactly point i");
+}
+
+/// the data shared by the evaluation threads
+struct ThreadData{
+	const jlib::GenericLinePath< double > * path;
+	const std::vector< double > * ss;
+	const std::vector< double > * values;
+	const std::vector< double > * tangents;
+	int offset;
+	int mismatches;
+};
+
+/// evaluates the path in a thread-specific order and compares to the reference
+void * evaluate(void * arg){
+
+	ThreadData & t = *static_cast< ThreadData * >(arg);
+	const std::vector< double > & ss = *t.ss;
+	int n = ss.size();
+
+	for(int rep = 0; rep < 20; rep++){
+		for(int k = 0; k < n; k++){
+			int i = ( k * 7 + t.offset + rep ) % n;
+			if((*t.path)[ss[i]] != (*t.values)[i]) t.mismatches++;
+			if(t.path->getTangent(ss[i]) != (*t.tangents)[i]) t.mismatches++;
+		}
+	}
+	return 0;
+}
+
+void testConcurrentEvaluation(int threads){
+
+	jlib::GenericLinePath< double > path = makePath(200);
+
+	// serial reference:
+	int n = 2000;
+	std::vector< double > ss(n), values(n), tangents(n);
+	for(int i = 0; i < n; i++){
+		ss[i]       = double(i) / ( n - 1 );
+		values[i]   = path[ss[i]];
+		tangents[i] = path.getTangent(ss[i]);
+	}
+
+	// concurrent evaluation, joining every thread that was started:
+	std::vector< pthread_t > ids(threads);
+	std::vector< ThreadData > data(threads);
+	int started = 0;
+	for(int t = 0; t < threads; t++){
+		data[t].path       = &path;
+		data[t].ss         = &ss;
+		data[t].values     = &values;
+		data[t].tangents   = &tangents;
+		data[t].offset     = t * 131;
+		data[t].mismatches = 0;
+		if(pthread_create(&ids[t], 0, evaluate, &data[t]) != 0) break;
+		started++;
+	}
+	bool ok = started == threads;
+	for(int t = 0; t < started; t++){
+		pthread_join(ids[t], 0);
+		if(data[t].mismatches > 0) ok = false;
+	}
+
+	char name[100];
+	std::sprintf(name, "GenericLinePath: concurrent evaluation, %d threads", threads);
+	check(ok, name);
+}
+
+} // End anonymous namespace
+
+// * * * * * * * * * * * * * * * * Main  * * * * * * * * * * * * * * * * * * //
+
+int main(int argc, char * argv[]){
+
+	// read arguments:
+	int threads = 8;
+	for(int i = 1; i < argc; i++){
+		if(std::strcmp(argv[i], "-threads") == 0 && i + 1 < argc){
+			threads = std::atoi(argv[++i]);
+		} else {
+			std::fprintf(stderr, "Usage: %s [-threads <n>]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	// run:
+	testHashTable();
+	testFixedStencils();
+	testAllocationFree();
+	testFrozenUpdate();
+	testLinePathErase();
+	testConcurrentEvaluation(threads);
+
+	if(failures > 0){
+		std::printf("\n%d check(s) failed\n", failures);
+		return 1;
+	}
+	std::printf("\nAll checks passed\n");
+	return 0;
+}
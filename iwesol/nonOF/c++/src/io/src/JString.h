@@ -42,6 +42,8 @@ References
 #include <iostream>
 #include <vector>
 
+#include "NumberFormat.h"
+
 namespace jlib {
 
 /**
@@ -278,75 +280,47 @@ inline String::String(const std::vector<std::string> & vs) {
 
 inline String::String(const std::vector<int> & vi) {
 
-	String out = "";
-
 	for (unsigned int i = 0; i < vi.size(); i++) {
 		if (i > 0)
-			out += " ";
-		out += String(vi[i]);
+			*this += ' ';
+		NumberFormat::appendInt(*this, vi[i]);
 	}
-
-	*this = out;
 }
 
 inline String::String(const std::vector<double> & vd) {
 
-	String out = "";
-
 	for (unsigned int i = 0; i < vd.size(); i++) {
 		if (i > 0)
-			out += " ";
-		out += String(vd[i]);
+			*this += ' ';
+		NumberFormat::appendGeneral(*this, vd[i]);
 	}
-
-	*this = out;
 }
 
 inline String::String(const std::vector<float> & vf) {
 
-	String out = "";
-
 	for (unsigned int i = 0; i < vf.size(); i++) {
 		if (i > 0)
-			out += " ";
-		out += String(vf[i]);
+			*this += ' ';
+		NumberFormat::appendGeneral(*this, vf[i]);
 	}
-
-	*this = out;
 }
 
 
 
 inline String::String(const double & value) {
-
-	std::stringstream ss;
-	ss << value;
-
-	*this =  ss.str();
+	NumberFormat::appendGeneral(*this, value);
 }
 
 inline String::String(const float & value) {
-
-	std::stringstream ss;
-	ss << value;
-
-	*this = ss.str();
+	NumberFormat::appendGeneral(*this, value);
 }
 
 inline String::String(const int & value) {
-
-	std::stringstream ss;
-	ss << value;
-
-	*this = ss.str();
+	NumberFormat::appendInt(*this, value);
 }
 
-inline String::String(const char & c) {
-
-	std::stringstream ss;
-	ss << c;
-
-	*this = ss.str();
+inline String::String(const char & c):
+	std::string(1, c) {
 }
 
 inline String::String(int ac, char* av[]) {
@@ -0,0 +1,112 @@
+/*---------------------------------------------------------------------------*\
+                               |
+  _____        _______ ____    | IWESOL: IWES Open Library
+ |_ _\ \      / / ____/ ___|   |
+  | | \ \ /\ / /|  _| \___ \   | Copyright: Fraunhofer Institute for Wind
+  | |  \ V  V / | |___ ___) |  | Energy and Energy System Technology IWES
+ |___|  \_/\_/  |_____|____/   |
+                               | http://www.iwes.fraunhofer.de
+                               |
+-------------------------------------------------------------------------------
+License
+    This file is part of IWESOL.
+
+    IWESOL is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IWESOL is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with IWESOL.  If not, see <http://www.gnu.org/licenses/>.
+
+Namespace
+    jlib::NumberFormat
+
+Description
+
+SourceFiles
+    NumberFormat.cpp
+
+References
+
+\*---------------------------------------------------------------------------*/
+
+#include <cstdio>
+#include <cmath>
+
+#include "NumberFormat.h"
+
+namespace jlib{
+
+namespace NumberFormat{
+
+namespace{
+
+/// the maximal number of significant digits or decimals, keeps the output within BUFFER_SIZE
+const int MAX_DIGITS = 17;
+
+/// fixed notation beyond this magnitude does not fit into BUFFER_SIZE
+const double MAX_FIXED = 1e20;
+
+inline int clampDigits(int digits){
+	if(digits < 0) return 0;
+	if(digits > MAX_DIGITS) return MAX_DIGITS;
+	return digits;
+}
+
+}
+
+int formatInt(long value, char * buf){
+
+	// digits in reverse order, using negative numbers to cover LONG_MIN:
+	char rev[BUFFER_SIZE];
+	int n  = 0;
+	long v = value < 0 ? value : -value;
+	do{
+		rev[n++] = char('0' - v % 10);
+		v       /= 10;
+	} while(v != 0);
+
+	// sign and digits:
+	int out = 0;
+	if(value < 0) buf[out++] = '-';
+	while(n > 0) buf[out++] = rev[--n];
+	buf[out] = '\0';
+
+	return out;
+}
+
+int formatGeneral(double value, char * buf, int precision){
+
+	// integral values, the common case for keys and indices:
+	if(value == std::floor(value) && std::fabs(value) < 1e6 && precision >= 6){
+		if(value == 0 && 1. / value < 0){
+			buf[0] = '-';
+			buf[1] = '0';
+			buf[2] = '\0';
+			return 2;
+		}
+		return formatInt(long(value), buf);
+	}
+
+	// ostream uses %g with precision, zero meaning one:
+	return std::sprintf(buf, "%.*g", precision > 0 ? clampDigits(precision) : 1, value);
+}
+
+int formatFixed(double value, char * buf, int decimals){
+	if(std::fabs(value) >= MAX_FIXED) return formatScientific(value, buf, decimals);
+	return std::sprintf(buf, "%.*f", clampDigits(decimals), value);
+}
+
+int formatScientific(double value, char * buf, int decimals){
+	return std::sprintf(buf, "%.*e", clampDigits(decimals), value);
+}
+
+} /* end namespace NumberFormat */
+
+} /* end namespace jlib */
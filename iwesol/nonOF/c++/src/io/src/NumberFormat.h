@@ -0,0 +1,114 @@
+/*---------------------------------------------------------------------------*\
+                               |
+  _____        _______ ____    | IWESOL: IWES Open Library
+ |_ _\ \      / / ____/ ___|   |
+  | | \ \ /\ / /|  _| \___ \   | Copyright: Fraunhofer Institute for Wind
+  | |  \ V  V / | |___ ___) |  | Energy and Energy System Technology IWES
+ |___|  \_/\_/  |_____|____/   |
+                               | http://www.iwes.fraunhofer.de
+                               |
+-------------------------------------------------------------------------------
+License
+    This file is part of IWESOL.
+
+    IWESOL is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IWESOL is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with IWESOL.  If not, see <http://www.gnu.org/licenses/>.
+
+Namespace
+    jlib::NumberFormat
+
+Description
+    Formatting of numbers into character buffers, without streams.
+    The general format is identical to std::ostream output with the
+    given precision, fixed and scientific formats correspond to the
+    std::ios::fixed and std::ios::scientific flags.
+
+SourceFiles
+    NumberFormat.cpp
+
+References
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef NUMBERFORMAT_H_
+#define NUMBERFORMAT_H_
+
+#include <string>
+
+namespace jlib{
+
+namespace NumberFormat{
+
+/// sufficient size of a buffer for one formatted number, including the terminating zero
+const int BUFFER_SIZE = 48;
+
+/// the default precision of the general format, as for std::ostream
+const int DEFAULT_PRECISION = 6;
+
+/// writes an integer to buf, returns the number of characters
+int formatInt(long value, char * buf);
+
+/// writes value to buf like std::ostream with given precision, returns the number of characters
+int formatGeneral(double value, char * buf, int precision = DEFAULT_PRECISION);
+
+/// writes value to buf with a fixed number of decimals, returns the number of characters
+int formatFixed(double value, char * buf, int decimals);
+
+/// writes value to buf in scientific notation, returns the number of characters
+int formatScientific(double value, char * buf, int decimals);
+
+/// appends an integer to s
+inline void appendInt(std::string & s, long value);
+
+/// appends value to s like std::ostream with given precision
+inline void appendGeneral(std::string & s, double value, int precision = DEFAULT_PRECISION);
+
+/// appends value to s with a fixed number of decimals, right aligned to width
+inline void appendFixed(std::string & s, double value, int decimals, int width = 0);
+
+/// appends value to s in scientific notation, right aligned to width
+inline void appendScientific(std::string & s, double value, int decimals, int width = 0);
+
+/// appends buf to s, right aligned to width
+inline void appendAligned(std::string & s, const char * buf, int n, int width);
+
+inline void appendAligned(std::string & s, const char * buf, int n, int width){
+	if(width > n) s.append(width - n, ' ');
+	s.append(buf, n);
+}
+
+inline void appendInt(std::string & s, long value){
+	char buf[BUFFER_SIZE];
+	s.append(buf, formatInt(value, buf));
+}
+
+inline void appendGeneral(std::string & s, double value, int precision){
+	char buf[BUFFER_SIZE];
+	s.append(buf, formatGeneral(value, buf, precision));
+}
+
+inline void appendFixed(std::string & s, double value, int decimals, int width){
+	char buf[BUFFER_SIZE];
+	appendAligned(s, buf, formatFixed(value, buf, decimals), width);
+}
+
+inline void appendScientific(std::string & s, double value, int decimals, int width){
+	char buf[BUFFER_SIZE];
+	appendAligned(s, buf, formatScientific(value, buf, decimals), width);
+}
+
+} /* end namespace NumberFormat */
+
+} /* end namespace jlib */
+
+#endif /* NUMBERFORMAT_H_ */
@@ -38,6 +38,7 @@ using namespace std;
 
 #include "OManager.h"
 #include "JString.h"
+#include "NumberFormat.h"
 
 namespace jlib{
 
@@ -79,7 +80,9 @@ void OManager::readFunc_ffc(Outputable* obj,
 	// write function:
 	for(float x = xmin; x <= xmax; x += deltax){
 		if(x > xmin) content += "\n";
-		content += String(x) + " " + String((obj->*f)(x));
+		NumberFormat::appendGeneral(content, x);
+		content += ' ';
+		NumberFormat::appendGeneral(content, (obj->*f)(x));
 	}
 
 }
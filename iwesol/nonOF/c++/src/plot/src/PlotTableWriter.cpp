@@ -41,6 +41,7 @@ using namespace std;
 #include "PlotTableWriter.h"
 #include "OManager.h"
 #include "Plot.h"
+#include "NumberFormat.h"
 
 namespace jlib {
 
@@ -125,43 +126,39 @@ Outputable::OData PlotTableWriter::getOData(
 			dat.data       = "";
 			int row        = 0;
 			bool dataFound = true;
+			string line;
 			while(dataFound){
 				dataFound = false;
-				std::stringstream ss;
-				ss << "\n";
+				line      = "\n";
 				for(int i = 0; i < int(m_plot->size()); i++){
 					if(i == 0){
 						int adr_x          = m_plot->m_adr[m_plot->key(i,"X")];
 						const Plot::column & col = m_plot->m_data[adr_x];
 						if(row < int(col.size())){
 							dataFound = true;
-							if(m_scientific_x) ss << setiosflags(ios::scientific);
-							else ss << setiosflags(ios::fixed);
-							ss 	<< setprecision(m_precision_x)
-								<< setw(m_colWidth_x)
-								<< right
-								<< m_plot->m_data[adr_x][row];
+							if(m_scientific_x){
+								NumberFormat::appendScientific(line,col[row],m_precision_x,m_colWidth_x);
+							} else {
+								NumberFormat::appendFixed(line,col[row],m_precision_x,m_colWidth_x);
+							}
 						}
 					}
 					int adr_y          = m_plot->m_adr[m_plot->key(i,"Y")];
 					const Plot::column & col = m_plot->m_data[adr_y];
 					if(row < int(col.size())){
 						dataFound = true;
-						if(m_scientific_y) ss << setiosflags(ios::scientific);
-						else ss << setiosflags(ios::fixed);
-						ss 	<< setprecision(m_precision_y)
-							<< setw(m_colWidth_y)
-							<< right
-							<< m_plot->m_data[adr_y][row];
+						if(m_scientific_y){
+							NumberFormat::appendScientific(line,col[row],m_precision_y,m_colWidth_y);
+						} else {
+							NumberFormat::appendFixed(line,col[row],m_precision_y,m_colWidth_y);
+						}
 					} else if( dataFound == true ){
-						ss 	<< setw(m_colWidth_y)
-							<< right
-							<< "NaN";
+						NumberFormat::appendAligned(line,"NaN",3,m_colWidth_y);
 					}
 				}
 				if(dataFound){
 					row++;
-					dat.data += ss.str();
+					dat.data += line;
 				}
 			}
 		}
@@ -0,0 +1,145 @@
+/*---------------------------------------------------------------------------*\
+                               |
+  _____        _______ ____    | IWESOL: IWES Open Library
+ |_ _\ \      / / ____/ ___|   |
+  | | \ \ /\ / /|  _| \___ \   | Copyright: Fraunhofer Institute for Wind
+  | |  \ V  V / | |___ ___) |  | Energy and Energy System Technology IWES
+ |___|  \_/\_/  |_____|____/   |
+                               | http://www.iwes.fraunhofer.de
+                               |
+-------------------------------------------------------------------------------
+License
+    This file is part of IWESOL.
+
+    IWESOL is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    IWESOL is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with IWESOL.  If not, see <http://www.gnu.org/licenses/>.
+
+
+Application
+    plotTest
+
+Description
+    Checks of the jlib plot library: the PlotTableWriter data rows for
+    all combinations of fixed and scientific x and y columns. Each column
+    follows its own flag, also when x and y flags differ.
+
+    Usage: plotTest
+
+SourceFiles
+    plotTest.cpp
+
+\*---------------------------------------------------------------------------*/
+
+#include <cstdio>
+#include <vector>
+#include <string>
+
+#include "Plot.h"
+#include "Plotable.h"
+#include "PlotTableWriter.h"
+
+// * * * * * * * * * * * * * * * * Helpers * * * * * * * * * * * * * * * * * //
+
+namespace {
+
+/// the number of failed checks
+int failures = 0;
+
+/// reports a check
+void check(bool ok, const std::string & name){
+	std::printf("%-60s %s\n", name.c_str(), ok ? "passed" : "FAILED");
+	if(!ok) failures++;
+}
+
+/// a table with an x column and two y columns
+class Table:
+	public jlib::Plotable{
+
+public:
+
+	/// the values of the column i at row j
+	static double value(int i, int j){ return ( i + 1 ) * ( j * j * 12.345 - 0.0678 ); }
+
+	/// Plotable: returns the number of columns
+	int getPlotColumns() const { return 3; }
+
+	/// Plotable: returns column i
+	std::vector<double> getPlotColumn(int i) const {
+		std::vector<double> out(5);
+		for(int j = 0; j < int(out.size()); j++) out[j] = value(i, j);
+		return out;
+	}
+
+	/// Plotable: returns the label of column i
+	std::string getPlotColumnLabel(int i) const { return i == 0 ? "x" : "y"; }
+};
+
+/// appends value to s like printf with the given flag, width 13 and precision 2
+void appendExpected(std::string & s, double value, bool scientific){
+	char buf[64];
+	std::sprintf(buf, scientific ? "%13.2e" : "%13.2f", value);
+	s += buf;
+}
+
+// * * * * * * * * * * * * * * * * Checks  * * * * * * * * * * * * * * * * * //
+
+void testTableFormats(){
+
+	Table table;
+	jlib::Plot plot("plotTest");
+	plot.addLine(&table, 0, 1, "a");
+	plot.addLine(&table, 0, 2, "b");
+
+	for(int sx = 0; sx < 2; sx++){
+		for(int sy = 0; sy < 2; sy++){
+
+			// expected rows:
+			std::string expected;
+			for(int j = 0; j < 5; j++){
+				expected += "\n";
+				appendExpected(expected, Table::value(0, j), sx);
+				appendExpected(expected, Table::value(1, j), sy);
+				appendExpected(expected, Table::value(2, j), sy);
+			}
+
+			jlib::PlotTableWriter writer(&plot, 13, 13, 2, 2, sx, sy);
+			jlib::Outputable::OData d = writer.getOData(jlib::IO::OFILE::TYPE::TXT);
+
+			char name[100];
+			std::sprintf(
+					name,
+					"PlotTableWriter: %s x, %s y columns",
+					sx ? "scientific" : "fixed",
+					sy ? "scientific" : "fixed"
+					);
+			check(d.size() == 1 && d[0].data == expected, name);
+		}
+	}
+}
+
+} // End anonymous namespace
+
+// * * * * * * * * * * * * * * * * Main  * * * * * * * * * * * * * * * * * * //
+
+int main(int argc, char * argv[]){
+
+	// run:
+	testTableFormats();
+
+	if(failures > 0){
+		std::printf("\n%d check(s) failed\n", failures);
+		return 1;
+	}
+	std::printf("\nAll checks passed\n");
+	return 0;
+}